@@ -0,0 +1,220 @@
+#include "Memory.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+// ---------------------------------------------------------------------------
+// Heap allocation counter (replaces the global operator new / delete)
+// ---------------------------------------------------------------------------
+static std::atomic<std::size_t> g_heapAllocs{0};
+
+// malloc with the standard new-handler retry loop
+static void *mallocOrThrow(std::size_t size) {
+  for (;;) {
+    if (void *p = std::malloc(size))
+      return p;
+    std::new_handler handler = std::get_new_handler();
+    if (!handler)
+      throw std::bad_alloc();
+    handler();
+  }
+}
+
+void *operator new(std::size_t size) {
+  g_heapAllocs.fetch_add(1, std::memory_order_relaxed);
+  return mallocOrThrow(size ? size : 1);
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+// over-aligned: over-allocate with malloc and stash the original pointer
+// right before the returned block (aligned_alloc is not available on MSVC)
+void *operator new(std::size_t size, std::align_val_t al) {
+  g_heapAllocs.fetch_add(1, std::memory_order_relaxed);
+  const auto align = static_cast<std::size_t>(al);
+  if (size > SIZE_MAX - align - sizeof(void *))
+    throw std::bad_alloc();
+  void *raw = mallocOrThrow(size + align + sizeof(void *));
+  auto p = reinterpret_cast<std::uintptr_t>(raw) + sizeof(void *);
+  p = (p + align - 1) & ~(static_cast<std::uintptr_t>(align) - 1);
+  reinterpret_cast<void **>(p)[-1] = raw;
+  return reinterpret_cast<void *>(p);
+}
+
+void operator delete(void *p, std::align_val_t) noexcept {
+  if (p)
+    std::free(static_cast<void **>(p)[-1]);
+}
+void operator delete(void *p, std::size_t, std::align_val_t al) noexcept {
+  operator delete(p, al);
+}
+
+std::size_t heapAllocCount() {
+  return g_heapAllocs.load(std::memory_order_relaxed);
+}
+
+static std::size_t alignUp(std::size_t v, std::size_t align) {
+  return (v + align - 1) & ~(align - 1);
+}
+
+// ---------------------------------------------------------------------------
+// MemoryStats
+// ---------------------------------------------------------------------------
+const char *memCategoryName(MemCategory c) {
+  switch (c) {
+  case MemCategory::VertexBuffer:
+    return "vertex buffers";
+  case MemCategory::IndexBuffer:
+    return "index buffers";
+  case MemCategory::Program:
+    return "programs";
+  case MemCategory::Transient:
+    return "transient";
+  default:
+    return "?";
+  }
+}
+
+MemoryStats &MemoryStats::get() {
+  static MemoryStats stats;
+  return stats;
+}
+
+void MemoryStats::add(MemCategory c, std::size_t bytes) {
+  const auto i = static_cast<std::size_t>(c);
+  m_current[i] += bytes;
+  if (m_current[i] > m_peak[i])
+    m_peak[i] = m_current[i];
+
+  if (c == MemCategory::Transient)
+    return;
+  const std::size_t gpu = gpuCurrent();
+  if (gpu > m_gpuPeak)
+    m_gpuPeak = gpu;
+  if (overBudget() && !m_budgetWarned) {
+    std::fprintf(stderr, "Memory: GPU budget exceeded (%zu / %zu bytes)\n", gpu,
+                 m_gpuBudget);
+    m_budgetWarned = true;
+  }
+}
+
+void MemoryStats::remove(MemCategory c, std::size_t bytes) {
+  const auto i = static_cast<std::size_t>(c);
+  // more than was added means a double release or a size mismatch
+  assert(bytes <= m_current[i]);
+  m_current[i] -= bytes;
+  if (!overBudget())
+    m_budgetWarned = false;
+}
+
+std::size_t MemoryStats::current(MemCategory c) const {
+  return m_current[static_cast<std::size_t>(c)];
+}
+
+std::size_t MemoryStats::peak(MemCategory c) const {
+  return m_peak[static_cast<std::size_t>(c)];
+}
+
+std::size_t MemoryStats::gpuCurrent() const {
+  return current(MemCategory::VertexBuffer) + current(MemCategory::IndexBuffer) +
+         current(MemCategory::Program);
+}
+
+bool MemoryStats::overBudget() const {
+  return m_gpuBudget != 0 && gpuCurrent() > m_gpuBudget;
+}
+
+void MemoryStats::report() const {
+  std::fprintf(stderr, "Memory: %-16s %12s %12s\n", "category", "current",
+               "peak");
+  for (std::size_t i = 0; i < kCount; ++i) {
+    std::fprintf(stderr, "Memory: %-16s %12zu %12zu\n",
+                 memCategoryName(static_cast<MemCategory>(i)), m_current[i],
+                 m_peak[i]);
+  }
+  std::fprintf(stderr, "Memory: GPU %zu bytes (peak %zu, budget %zu)\n",
+               gpuCurrent(), m_gpuPeak, m_gpuBudget);
+  std::fprintf(stderr, "Memory: heap allocations %zu\n", heapAllocCount());
+}
+
+// ---------------------------------------------------------------------------
+// FrameArena
+// ---------------------------------------------------------------------------
+FrameArena::FrameArena(std::size_t capacity, std::pmr::memory_resource *upstream)
+    : m_upstream(upstream), m_capacity(capacity) {
+  if (m_capacity)
+    m_buffer = static_cast<std::byte *>(
+        m_upstream->allocate(m_capacity, alignof(std::max_align_t)));
+}
+
+FrameArena::~FrameArena() {
+  reset();
+  if (m_buffer)
+    m_upstream->deallocate(m_buffer, m_capacity, alignof(std::max_align_t));
+}
+
+void FrameArena::reset() {
+  while (m_overflowList) {
+    Overflow *o = m_overflowList;
+    m_overflowList = o->next;
+    m_upstream->deallocate(o, o->bytes, o->align);
+  }
+  m_offset = 0;
+  m_overflowBytes = 0;
+}
+
+void *FrameArena::do_allocate(std::size_t bytes, std::size_t align) {
+  // align relative to the address, the buffer itself is max_align_t aligned
+  const auto base = reinterpret_cast<std::uintptr_t>(m_buffer);
+  const std::size_t start = alignUp(base + m_offset, align) - base;
+  if (m_buffer && start + bytes <= m_capacity) {
+    m_offset = start + bytes;
+    if (m_offset > m_peak)
+      m_peak = m_offset;
+    return m_buffer + start;
+  }
+
+  // doesn't fit: header + payload from upstream, released on reset()
+  ++m_overflows;
+  m_overflowBytes += bytes;
+  const std::size_t blockAlign = align > alignof(Overflow) ? align : alignof(Overflow);
+  const std::size_t header = alignUp(sizeof(Overflow), blockAlign);
+  auto *raw = static_cast<std::byte *>(m_upstream->allocate(header + bytes, blockAlign));
+  auto *o = new (raw) Overflow{m_overflowList, header + bytes, blockAlign};
+  m_overflowList = o;
+  return raw + header;
+}
+
+void FrameArena::do_deallocate(void *, std::size_t, std::size_t) {}
+
+// ---------------------------------------------------------------------------
+// FrameAllocator
+// ---------------------------------------------------------------------------
+FrameAllocator::FrameAllocator(std::size_t capacityPerFrame)
+    : m_arenas{std::make_unique<FrameArena>(capacityPerFrame),
+               std::make_unique<FrameArena>(capacityPerFrame)} {}
+
+static std::size_t arenaBytes(const FrameArena &a) {
+  return a.used() + a.overflowBytes();
+}
+
+FrameAllocator::~FrameAllocator() {
+  // the current arena is not recorded yet, only the previous frame is
+  MemoryStats::get().remove(MemCategory::Transient, arenaBytes(*m_arenas[m_index ^ 1]));
+}
+
+void FrameAllocator::endFrame() {
+  MemoryStats &stats = MemoryStats::get();
+  stats.add(MemCategory::Transient, arenaBytes(*m_arenas[m_index]));
+
+  m_index ^= 1;
+  stats.remove(MemCategory::Transient, arenaBytes(*m_arenas[m_index]));
+  m_arenas[m_index]->reset();
+}
+
+std::size_t FrameAllocator::overflowCount() const {
+  return m_arenas[0]->overflowCount() + m_arenas[1]->overflowCount();
+}
@@ -0,0 +1,115 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+
+// Categories tracked by MemoryStats. GPU categories count against the budget.
+enum class MemCategory : std::uint8_t {
+  VertexBuffer,
+  IndexBuffer,
+  Program,
+  Transient,
+  Count
+};
+
+const char *memCategoryName(MemCategory c);
+
+// Byte accounting per category with high-water marks and a GPU budget.
+class MemoryStats {
+public:
+  static MemoryStats &get();
+
+  void add(MemCategory c, std::size_t bytes);
+  void remove(MemCategory c, std::size_t bytes); // asserts on underflow
+
+  std::size_t current(MemCategory c) const;
+  std::size_t peak(MemCategory c) const;
+
+  // GPU = vertex + index + program. 0 disables the budget check.
+  void setGpuBudget(std::size_t bytes) { m_gpuBudget = bytes; }
+  std::size_t gpuBudget() const { return m_gpuBudget; }
+  std::size_t gpuCurrent() const;
+  std::size_t gpuPeak() const { return m_gpuPeak; }
+  bool overBudget() const;
+
+  void report() const; // stderr
+
+private:
+  MemoryStats() = default;
+
+  static constexpr std::size_t kCount = static_cast<std::size_t>(MemCategory::Count);
+  std::array<std::size_t, kCount> m_current{};
+  std::array<std::size_t, kCount> m_peak{};
+  std::size_t m_gpuBudget{0};
+  std::size_t m_gpuPeak{0};
+  bool m_budgetWarned{false};
+};
+
+// Number of global operator new calls since startup (all threads).
+std::size_t heapAllocCount();
+
+// Bump allocator over a fixed buffer. deallocate() is a no-op, reset() frees
+// everything at once. Requests that don't fit go to the upstream resource
+// and are counted as overflows, so a sized-right arena never hits the heap.
+class FrameArena : public std::pmr::memory_resource {
+public:
+  explicit FrameArena(std::size_t capacity,
+                      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+  ~FrameArena() override;
+
+  FrameArena(const FrameArena &) = delete;
+  FrameArena &operator=(const FrameArena &) = delete;
+
+  void reset();
+
+  std::size_t capacity() const { return m_capacity; }
+  std::size_t used() const { return m_offset; }
+  std::size_t peak() const { return m_peak; }
+  std::size_t overflowCount() const { return m_overflows; }
+  std::size_t overflowBytes() const { return m_overflowBytes; } // since reset()
+
+private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override;
+  void do_deallocate(void *p, std::size_t bytes, std::size_t align) override;
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+
+  struct Overflow {
+    Overflow *next;
+    std::size_t bytes;
+    std::size_t align;
+  };
+
+  std::pmr::memory_resource *m_upstream;
+  std::byte *m_buffer{nullptr};
+  std::size_t m_capacity{0};
+  std::size_t m_offset{0};
+  std::size_t m_peak{0};
+  std::size_t m_overflows{0};
+  std::size_t m_overflowBytes{0};
+  Overflow *m_overflowList{nullptr};
+};
+
+// Two arenas, swapped at frame end: data written in frame N stays valid
+// while frame N+1 is built (e.g. for buffers still read by the GPU).
+class FrameAllocator {
+public:
+  explicit FrameAllocator(std::size_t capacityPerFrame);
+  ~FrameAllocator(); // drops the still-recorded transient bytes
+
+  FrameArena &current() { return *m_arenas[m_index]; }
+  std::pmr::memory_resource *resource() { return m_arenas[m_index].get(); }
+
+  // Records transient usage (buffer + overflow bytes), flips to the other
+  // arena and resets it.
+  void endFrame();
+
+  std::size_t overflowCount() const;
+
+private:
+  std::array<std::unique_ptr<FrameArena>, 2> m_arenas;
+  std::size_t m_index{0};
+};
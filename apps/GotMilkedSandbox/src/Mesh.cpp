@@ -1,12 +1,22 @@
 #include "Mesh.hpp"
+#include "Memory.hpp"
 
-Mesh::~Mesh() {
-  if (m_ebo)
+Mesh::~Mesh() { release(); }
+
+void Mesh::release() {
+  MemoryStats &stats = MemoryStats::get();
+  if (m_ebo) {
     glDeleteBuffers(1, &m_ebo);
-  if (m_vbo)
+    stats.remove(MemCategory::IndexBuffer, m_eboBytes);
+  }
+  if (m_vbo) {
     glDeleteBuffers(1, &m_vbo);
+    stats.remove(MemCategory::VertexBuffer, m_vboBytes);
+  }
   if (m_vao)
     glDeleteVertexArrays(1, &m_vao);
+  m_ebo = m_vbo = m_vao = 0;
+  m_eboBytes = m_vboBytes = 0;
 }
 
 Mesh::Mesh(Mesh &&other) noexcept {
@@ -16,6 +26,10 @@ Mesh::Mesh(Mesh &&other) noexcept {
   other.m_vbo = 0;
   m_ebo = other.m_ebo;
   other.m_ebo = 0;
+  m_vboBytes = other.m_vboBytes;
+  other.m_vboBytes = 0;
+  m_eboBytes = other.m_eboBytes;
+  other.m_eboBytes = 0;
   m_vertexCount = other.m_vertexCount;
   other.m_vertexCount = 0;
   m_indexCount = other.m_indexCount;
@@ -26,12 +40,7 @@ Mesh::Mesh(Mesh &&other) noexcept {
 
 Mesh &Mesh::operator=(Mesh &&other) noexcept {
   if (this != &other) {
-    if (m_ebo)
-      glDeleteBuffers(1, &m_ebo);
-    if (m_vbo)
-      glDeleteBuffers(1, &m_vbo);
-    if (m_vao)
-      glDeleteVertexArrays(1, &m_vao);
+    release();
 
     m_vao = other.m_vao;
     other.m_vao = 0;
@@ -39,6 +48,10 @@ Mesh &Mesh::operator=(Mesh &&other) noexcept {
     other.m_vbo = 0;
     m_ebo = other.m_ebo;
     other.m_ebo = 0;
+    m_vboBytes = other.m_vboBytes;
+    other.m_vboBytes = 0;
+    m_eboBytes = other.m_eboBytes;
+    other.m_eboBytes = 0;
     m_vertexCount = other.m_vertexCount;
     other.m_vertexCount = 0;
     m_indexCount = other.m_indexCount;
@@ -58,7 +71,9 @@ Mesh Mesh::fromPositions(const std::vector<float> &positions) {
 
   glGenBuffers(1, &m.m_vbo);
   glBindBuffer(GL_ARRAY_BUFFER, m.m_vbo);
-  glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(float), positions.data(), GL_STATIC_DRAW);
+  m.m_vboBytes = positions.size() * sizeof(float);
+  glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m.m_vboBytes), positions.data(), GL_STATIC_DRAW);
+  MemoryStats::get().add(MemCategory::VertexBuffer, m.m_vboBytes);
 
   glEnableVertexAttribArray(0);
   glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void *)0);
@@ -77,11 +92,15 @@ Mesh Mesh::fromIndexed(const std::vector<float> &positions, const std::vector<un
 
   glGenBuffers(1, &m.m_vbo);
   glBindBuffer(GL_ARRAY_BUFFER, m.m_vbo);
-  glBufferData(GL_ARRAY_BUFFER, positions.size() * sizeof(float), positions.data(), GL_STATIC_DRAW);
+  m.m_vboBytes = positions.size() * sizeof(float);
+  glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m.m_vboBytes), positions.data(), GL_STATIC_DRAW);
+  MemoryStats::get().add(MemCategory::VertexBuffer, m.m_vboBytes);
 
   glGenBuffers(1, &m.m_ebo);
   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m.m_ebo);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+  m.m_eboBytes = indices.size() * sizeof(unsigned int);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m.m_eboBytes), indices.data(), GL_STATIC_DRAW);
+  MemoryStats::get().add(MemCategory::IndexBuffer, m.m_eboBytes);
 
   glEnableVertexAttribArray(0);
   glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void *)0);
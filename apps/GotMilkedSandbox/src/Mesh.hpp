@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <glad/glad.h>
 #include <vector>
 
@@ -19,9 +20,13 @@ public:
   void draw() const;
 
 private:
+  void release();
+
   GLuint m_vao{0};
   GLuint m_vbo{0};
   GLuint m_ebo{0};          // optional (nur bei indexed)
+  std::size_t m_vboBytes{0}; // fr MemoryStats
+  std::size_t m_eboBytes{0};
   GLsizei m_vertexCount{0}; // fr drawArrays
   GLsizei m_indexCount{0};  // fr drawElements
   bool m_indexed{false};
@@ -1,38 +1,58 @@
 #include "Shader.hpp"
+#include "Memory.hpp"
 #include <cstdio>
 #include <fstream>
 #include <glm/gtc/type_ptr.hpp>
-#include <sstream>
 #include <vector>
 
-Shader::~Shader() {
-  if (m_id)
-    glDeleteProgram(m_id);
-}
+Shader::~Shader() { release(); }
 
 Shader::Shader(Shader &&other) noexcept {
   m_id = other.m_id;
   other.m_id = 0;
+  m_bytes = other.m_bytes;
+  other.m_bytes = 0;
 }
 Shader &Shader::operator=(Shader &&other) noexcept {
   if (this != &other) {
-    if (m_id)
-      glDeleteProgram(m_id);
+    release();
     m_id = other.m_id;
     other.m_id = 0;
+    m_bytes = other.m_bytes;
+    other.m_bytes = 0;
   }
   return *this;
 }
 
+void Shader::release() {
+  if (m_id) {
+    glDeleteProgram(m_id);
+    MemoryStats::get().remove(MemCategory::Program, m_bytes);
+  }
+  m_id = 0;
+  m_bytes = 0;
+}
+
 bool Shader::readFile(const std::string &path, std::string &out) {
   std::ifstream in(path, std::ios::binary);
   if (!in) {
     std::fprintf(stderr, "Shader: failed to open file: %s\n", path.c_str());
     return false;
   }
-  std::ostringstream ss;
-  ss << in.rdbuf();
-  out = ss.str();
+  // size up front and read straight into the string (one allocation)
+  in.seekg(0, std::ios::end);
+  const std::streamoff size = in.tellg();
+  if (size < 0) {
+    std::fprintf(stderr, "Shader: failed to read file: %s\n", path.c_str());
+    return false;
+  }
+  out.resize(static_cast<size_t>(size));
+  in.seekg(0, std::ios::beg);
+  in.read(out.data(), size);
+  if (!in) {
+    std::fprintf(stderr, "Shader: failed to read file: %s\n", path.c_str());
+    return false;
+  }
   return true;
 }
 
@@ -94,9 +114,14 @@ bool Shader::loadFromFiles(const std::string &vertPath,
   if (!prog)
     return false;
 
-  if (m_id)
-    glDeleteProgram(m_id);
+  release();
   m_id = prog;
+
+  // driver-side size isn't queryable; the program binary is a fair estimate
+  GLint binLen = 0;
+  glGetProgramiv(m_id, GL_PROGRAM_BINARY_LENGTH, &binLen);
+  m_bytes = static_cast<size_t>(binLen);
+  MemoryStats::get().add(MemCategory::Program, m_bytes);
   return true;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <glad/glad.h>
+#include <cstddef>
 #include <glm/glm.hpp>
 #include <string>
 
@@ -26,9 +27,11 @@ public:
   void setInt(const char *name, int v) const;
 
 private:
+  void release();
   static bool readFile(const std::string &path, std::string &out);
   static GLuint compile(GLenum type, const char *src);
   static GLuint link(GLuint vs, GLuint fs);
 
   GLuint m_id{0};
+  std::size_t m_bytes{0}; // accounted in MemoryStats
 };
@@ -1,6 +1,8 @@
 #include <cmath>
 #include <cstdio>
+#include <cstdlib>
 #include <fstream>
+#include <memory_resource>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -14,6 +16,7 @@
 #include <glm/gtc/type_ptr.hpp>
 
 #include "Camera.hpp"
+#include "Memory.hpp"
 #include "Shader.hpp"
 #include "Mesh.hpp"
 #include "Transform.hpp"
@@ -32,6 +35,17 @@ struct FovState {
 
 const char *NAME{"GotMilked:"};
 
+// memory limits
+static constexpr std::size_t GPU_BUDGET_BYTES = 256u * 1024u * 1024u;
+static constexpr std::size_t FRAME_ARENA_BYTES = 64u * 1024u;
+static constexpr int WARMUP_FRAMES = 3; // heap allocs allowed before steady state
+
+// one entry of the per-frame draw list (lives in the frame arena)
+struct DrawItem {
+  const Mesh *mesh;
+  glm::mat4 mvp;
+};
+
 #ifndef GM_ASSETS_DIR
 #error GM_ASSETS_DIR must be defined (see CMakeLists.txt)
 #endif
@@ -86,6 +100,11 @@ int main() {
   glfwSwapInterval(1);
   glEnable(GL_DEPTH_TEST);
 
+  MemoryStats::get().setGpuBudget(GPU_BUDGET_BYTES);
+  // report after meshes, shaders and arenas are gone: current = leaks
+  std::atexit([] { MemoryStats::get().report(); });
+  FrameAllocator frameAlloc(FRAME_ARENA_BYTES);
+
   // geometry
   std::vector<float> triVerts = {-0.5f, -0.5f, 0.0f, 0.5f, -0.5f,
                                  0.0f,  0.0f,  0.5f, 0.0f};
@@ -123,6 +142,22 @@ int main() {
   double lastTime = glfwGetTime();
   double lastTitle = lastTime;
   int frames = 0;
+  int frameIndex = 0;
+  std::size_t heapMark = heapAllocCount();
+
+  // runs after glfwPollEvents, so input callbacks are part of the measured
+  // frame; every steady-state frame that touches the heap is reported
+  auto finishFrame = [&]() {
+    frameAlloc.endFrame();
+    const std::size_t heapNow = heapAllocCount();
+    const std::size_t frameAllocs = heapNow - heapMark;
+    heapMark = heapNow;
+    if (++frameIndex > WARMUP_FRAMES && frameAllocs != 0) {
+      std::fprintf(stderr,
+                   "%s %zu heap allocation(s) in frame %d (arena overflows: %zu)\n",
+                   NAME, frameAllocs, frameIndex, frameAlloc.overflowCount());
+    }
+  };
 
   while (!glfwWindowShouldClose(window)) {
     const double now = glfwGetTime();
@@ -202,6 +237,7 @@ int main() {
     glfwGetFramebufferSize(window, &fbw, &fbh);
     if (fbw == 0 || fbh == 0) {
       glfwPollEvents();
+      finishFrame();
       continue;
     }
     glViewport(0, 0, fbw, fbh);
@@ -219,13 +255,15 @@ int main() {
 
     const float t = static_cast<float>(glfwGetTime());
 
+    // Draw-Liste im Frame-Arena (kein Heap im Frame-Loop)
+    std::pmr::vector<DrawItem> draws(frameAlloc.resource());
+    draws.reserve(2);
+
     // Objekt A: drehendes Dreieck (fromPositions)
     {
       Transform A;
       A.rotationDeg.z = t * 45.0f;
-      const glm::mat4 mvpA = viewProj * A.toMat4();
-      shader.setMat4("uMVP", mvpA);
-      tri.draw();
+      draws.push_back({&tri, viewProj * A.toMat4()});
     }
 
     // Objekt B: rechts versetztes, kleineres Quad (fromIndexed)
@@ -234,9 +272,12 @@ int main() {
       B.position = {1.2f, 0.0f, 0.0f};
       B.rotationDeg.z = -t * 60.0f;
       B.scale = {0.8f, 0.8f, 0.8f};
-      const glm::mat4 mvpB = viewProj * B.toMat4();
-      shader.setMat4("uMVP", mvpB);
-      quad.draw();
+      draws.push_back({&quad, viewProj * B.toMat4()});
+    }
+
+    for (const DrawItem &d : draws) {
+      shader.setMat4("uMVP", d.mvp);
+      d.mesh->draw();
     }
 
     frames++;
@@ -255,6 +296,7 @@ int main() {
 
     glfwSwapBuffers(window);
     glfwPollEvents();
+    finishFrame();
   }
 
   glfwDestroyWindow(window);